@@ -0,0 +1,62 @@
+#!/usr/bin/env bash
+# script/call_graph on a generated workspace of FILES scripts with
+# HANDLERS handlers each; every handler calls one in the same file and one
+# in another file. Times
+#   - a cold run on one job and on JOBS jobs (query extraction dominates);
+#   - a warm run with CACHE after editing one file, which only queries
+#     that file and redoes the join.
+# The join is a sort plus hash lookups, so every column should grow
+# linearly with FILES.
+#
+#   bench/call_graph.sh                     # FILES = 100 1000, HANDLERS = 20
+#   FILES="10000" HANDLERS=50 bench/call_graph.sh
+
+set -euo pipefail
+cd "$(dirname "$0")/.."
+
+export TS=${TS:-npx tree-sitter}
+FILES=${FILES:-100 1000}
+HANDLERS=${HANDLERS:-20}
+JOBS=${JOBS:-$(getconf _NPROCESSORS_ONLN 2>/dev/null || echo 1)}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+gen() {
+    local dir=$1 n=$2 i
+    mkdir -p "$dir"
+    for ((i = 0; i < n; i++)); do
+        awk -v file="$i" -v files="$n" -v n="$HANDLERS" 'BEGIN {
+            for (h = 0; h < n; h++) {
+                printf "on f%d_%d(x)\n", file, h
+                printf "\tset y to f%d_%d(x)\n", file, (h + 1) % n
+                printf "\treturn my f%d_%d(y)\n", (file + 1) % files, h
+                printf "end f%d_%d\n\n", file, h
+            }
+        }' >"$dir/s$i.applescript"
+    done
+}
+
+now_ns() {
+    # `date +%N` is GNU-only; fall back to python for BSD/macOS.
+    date +%s%N 2>/dev/null | grep -v N || python3 -c 'import time; print(time.time_ns())'
+}
+
+time_ms() {
+    local start
+    start=$(now_ns)
+    "$@" >/dev/null 2>&1 || true
+    echo $((($(now_ns) - start) / 1000000))
+}
+
+printf '%-8s %8s %12s %14s %14s\n' files edges "cold 1 job" "cold $JOBS jobs" "warm, 1 edit"
+for n in $FILES; do
+    dir=$tmp/ws_$n
+    gen "$dir" "$n"
+    edges=$(script/call_graph "$dir" 2>/dev/null | wc -l | tr -d ' ')
+    one=$(JOBS=1 time_ms script/call_graph "$dir")
+    many=$(JOBS=$JOBS time_ms script/call_graph "$dir")
+    CACHE=$tmp/cache_$n script/call_graph "$dir" >/dev/null 2>&1 || true
+    printf '\n' >>"$dir/s0.applescript"
+    warm=$(CACHE=$tmp/cache_$n time_ms script/call_graph "$dir")
+    printf '%-8s %8s %12s %14s %14s\n' "$n" "$edges" "$one" "$many" "$warm"
+done
@@ -0,0 +1,67 @@
+#!/usr/bin/env bash
+# Tree depth, parse/traversal time and peak memory on long operator chains.
+#
+# Generates `set s to "x" & "x" & … & "x"` with N operands (one line, and
+# the same chain wrapped with `¬` continuations every 20 operands), then:
+#   - parse only (`--quiet --time`),
+#   - parse + full tree walk (the CLI prints every node),
+#   - max tree depth, read off the printed S-expression's indentation,
+#   - peak RSS of the walk, via /usr/bin/time.
+#
+#   bench/chains.sh                     # N = 1000 10000 50000
+#   SIZES="100 100000" bench/chains.sh
+
+set -euo pipefail
+cd "$(dirname "$0")/.."
+
+TS=${TS:-npx tree-sitter}
+SIZES=${SIZES:-1000 10000 50000}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+gen() {
+    local n=$1 wrap=$2
+    awk -v n="$n" -v wrap="$wrap" 'BEGIN {
+        printf "set s to \"x\""
+        for (i = 1; i < n; i++) {
+            if (wrap && i % 20 == 0) printf " ¬\n    "
+            printf " & \"x\""
+        }
+        printf "\n"
+    }'
+}
+
+peak_rss_kb() {
+    if /usr/bin/time -v true >/dev/null 2>&1; then
+        /usr/bin/time -v "$@" 2>&1 >/dev/null | awk '/Maximum resident/ { print $NF }'
+    elif /usr/bin/time -l true >/dev/null 2>&1; then
+        # BSD/macOS: -l reports bytes.
+        /usr/bin/time -l "$@" 2>&1 >/dev/null | awk '/maximum resident/ { print int($1 / 1024) }'
+    fi
+}
+
+now_ns() {
+    # `date +%N` is GNU-only; fall back to python for BSD/macOS.
+    date +%s%N 2>/dev/null | grep -v N || python3 -c 'import time; print(time.time_ns())'
+}
+
+printf '%-8s %-6s %12s %14s %10s %12s\n' operands layout "parse ms" "parse+walk ms" depth "peak KiB"
+for n in $SIZES; do
+    for wrap in 0 1; do
+        f=$tmp/chain_${n}_$wrap.applescript
+        gen "$n" "$wrap" >"$f"
+
+        parse_ms=$($TS parse --quiet --time "$f" 2>&1 |
+            awk '{ for (i = 1; i < NF; i++) if ($(i + 1) == "ms") { print $i; exit } }')
+
+        start=$(now_ns)
+        $TS parse "$f" >"$tmp/tree.txt" 2>/dev/null || true
+        end=$(now_ns)
+
+        depth=$(awk '{ match($0, /^ */); d = RLENGTH / 2; if (d > m) m = d } END { print m + 0 }' "$tmp/tree.txt")
+        rss=$(peak_rss_kb $TS parse "$f")
+
+        printf '%-8s %-6s %12s %14d %10s %12s\n' "$n" "$([ "$wrap" = 1 ] && echo ¬ || echo line)" \
+            "${parse_ms:-?}" $(((end - start) / 1000000)) "$depth" "${rss:-?}"
+    done
+done
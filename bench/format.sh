@@ -0,0 +1,82 @@
+#!/usr/bin/env bash
+# script/format on large generated scripts: the whole file vs. the lines
+# of one edit.
+#
+# For each size N (lines), generates a script of handlers and `tell`
+# blocks and times
+#   - parse only (`parse --quiet`), the floor every CLI run pays;
+#   - script/format over the whole file;
+#   - script/format FIRST:LAST over EDIT lines in the middle of the file,
+#     which queries only that byte range and copies the rest.
+# Both format columns subtract the parse floor. The whole-file one grows
+# with N; the range one should only grow by the copy of the file.
+#
+#   bench/format.sh                     # N = 1000 10000 100000, EDIT = 20
+#   SIZES="500000" EDIT=200 bench/format.sh
+
+set -euo pipefail
+cd "$(dirname "$0")/.."
+
+export TS=${TS:-npx tree-sitter}
+SIZES=${SIZES:-1000 10000 100000}
+EDIT=${EDIT:-20}
+RUNS=${RUNS:-5}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+# Roughly N lines of handlers and `tell` blocks with mixed-case keywords
+# and flattened indentation, so every line has something to fix.
+gen() {
+    awk -v n="$1" 'BEGIN {
+        for (i = 0; lines < n; i++) {
+            printf "ON handler%d(theList, theName)\n", i
+            print "set total to 0"
+            print "Repeat with x in theList"
+            print "set total to total + ¬"
+            print "(x as integer) * 2"
+            print "End Repeat"
+            print "IF total > 100 Then"
+            print "display dialog \"Big: \" & total with title theName"
+            print "ELSE"
+            print "log \"small\""
+            print "END IF"
+            print "return {total:total, name:theName}"
+            printf "end handler%d\n", i
+            print "Tell application \"Finder\""
+            print "set f to name of every file of desktop"
+            printf "my handler%d(f, \"x\")\n", i
+            print "end tell"
+            print ""
+            lines += 18
+        }
+    }'
+}
+
+now_ns() {
+    # `date +%N` is GNU-only; fall back to python for BSD/macOS.
+    date +%s%N 2>/dev/null | grep -v N || python3 -c 'import time; print(time.time_ns())'
+}
+
+# Median wall ms of RUNS runs of the given command.
+median_ms() {
+    local i start
+    for ((i = 0; i < RUNS; i++)); do
+        start=$(now_ns)
+        "$@" >/dev/null 2>&1 || true
+        echo $((($(now_ns) - start) / 1000000))
+    done | sort -n | awk '{ v[NR] = $1 } END { print v[int((NR + 1) / 2)] }'
+}
+
+printf '%-8s %10s %12s %12s\n' lines "parse ms" "whole file" "$EDIT lines"
+for n in $SIZES; do
+    f=$tmp/gen_$n.applescript
+    gen "$n" >"$f"
+    total=$(wc -l <"$f" | tr -d ' ')
+    first=$((total / 2))
+
+    parse=$(median_ms $TS parse --quiet "$f")
+    whole=$(median_ms script/format "$f")
+    part=$(median_ms script/format "$f" "$first:$((first + EDIT - 1))")
+
+    printf '%-8s %10s %12s %12s\n' "$total" "$parse" "$((whole - parse))" "$((part - parse))"
+done
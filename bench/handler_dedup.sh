@@ -0,0 +1,43 @@
+#!/usr/bin/env bash
+# How much per-handler analysis a hash cache would skip on the corpus.
+#
+# `script/handler_hashes` hashes every handler's canonical source (comments,
+# whitespace, `¬` and case normalised away). Handlers with equal hashes
+# would share a cached analysis result, so everything after the first of
+# each group is work saved.
+#
+#   bench/handler_dedup.sh                 # active real-world corpus
+#   bench/handler_dedup.sh path/to/archive # any directory or files
+
+set -euo pipefail
+. "$(dirname "$0")/../script/lib.sh"
+
+files=()
+if [ $# -eq 0 ]; then
+    set -- test/corpus/realworld
+fi
+for p in "$@"; do
+    p=$(from_caller "$p")
+    if [ -d "$p" ]; then
+        while IFS= read -r f; do files+=("$f"); done \
+            < <(find "$p" -name '*.applescript' -not -path '*/known-limits/*' | sort)
+    else
+        files+=("$p")
+    fi
+done
+
+script/handler_hashes "${files[@]}" | sort |
+    awk -F'\t' '
+        {
+            total++; total_bytes += $2
+            if (seen[$1]++) { dup++; dup_bytes += $2 } else uniq++
+            group[$1] = group[$1] "\n    " $3 ":" $4
+            size[$1] = seen[$1]
+        }
+        END {
+            printf "handlers:            %d (%d bytes)\n", total, total_bytes
+            printf "distinct by hash:    %d\n", uniq
+            printf "analyses skipped:    %d (%.1f%%)\n", dup, total ? 100 * dup / total : 0
+            printf "bytes skipped:       %d (%.1f%%)\n", dup_bytes, total_bytes ? 100 * dup_bytes / total_bytes : 0
+            for (h in size) if (size[h] > 1) printf "\n%d copies of %s:%s\n", size[h], h, group[h]
+        }'
@@ -0,0 +1,160 @@
+#!/usr/bin/env bash
+# Cost of targeted injections vs. injecting every string.
+#
+# queries/injections.scm injects only the string argument of `do shell
+# script` (bash) and `run script` (AppleScript). Over the active corpus this
+#   - counts all `string` nodes vs. the injected ones, per language;
+#   - times the host-side passes: the AppleScript parse, the highlight query
+#     (if queries/highlights.scm exists) and the injection query;
+#   - times the child parses an injection-aware host would do: only the
+#     injected strings, vs. every string parsed as shell (what a host that
+#     injects on every `string` pays).
+# Child parses need the tree-sitter-bash grammar where the CLI can find it;
+# without it those rows are skipped.
+#
+# With --list it only prints what the injection query selects, one string
+# per line in file order, without timing anything:
+#
+#   path<TAB>line<TAB>column<TAB>language<TAB>content
+#
+# (line and column 1-based, at the opening quote; content without the
+# quotes, newlines kept).
+#
+#   bench/injections.sh
+#   bench/injections.sh path/to/scripts/
+#   bench/injections.sh --list path/to/script.applescript
+
+set -euo pipefail
+. "$(dirname "$0")/../script/lib.sh"
+
+TS=${TS:-npx tree-sitter}
+list=0
+if [ "${1:-}" = "--list" ]; then
+    list=1
+    shift
+fi
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+files=()
+if [ $# -eq 0 ]; then
+    set -- test/corpus/realworld
+fi
+for p in "$@"; do
+    p=$(from_caller "$p")
+    if [ -d "$p" ]; then
+        while IFS= read -r f; do files+=("$f"); done \
+            < <(find "$p" -name '*.applescript' -not -path '*/known-limits/*' | sort)
+    else
+        files+=("$p")
+    fi
+done
+
+now_ns() {
+    # `date +%N` is GNU-only; fall back to python for BSD/macOS.
+    date +%s%N 2>/dev/null | grep -v N || python3 -c 'import time; print(time.time_ns())'
+}
+
+time_ms() {
+    local start
+    start=$(now_ns)
+    "$@" >/dev/null 2>&1 || true
+    echo $((($(now_ns) - start) / 1000000))
+}
+
+# Writes the content (quotes stripped) of every capture in `$TS query $1`
+# to $2/<language>/<n>.txt, and one `language path row col file` line per
+# capture to $2/index.tsv. The language of a capture is the
+# `injection.language` of its pattern; patterns without one go to "string".
+extract() {
+    local query=$1 out=$2
+    awk '/#set! injection\.language/ { match($0, /"[^"]*"/); print substr($0, RSTART + 1, RLENGTH - 2) }' \
+        "$query" >"$tmp/languages.txt"
+    $TS query "$query" "${files[@]}" 2>/dev/null |
+        LC_ALL=C awk -v out="$out" -v langs="$tmp/languages.txt" '
+            BEGIN { while ((getline l < langs) > 0) lang[n_langs++] = l }
+            /^[^ ]/ { path = $0; loaded = ""; next }
+            /pattern:/ { pattern = $2 + 0; next }
+            # `capture: N - name, start: …, text: `…`` on one row,
+            # `capture: name, start: …` when the node spans rows.
+            /capture:/ {
+                line = $0; sub(/, text: `.*/, "", line)
+                name = line; sub(/^ *capture: ([0-9]+ - )?/, "", name); sub(/, start:.*/, "", name)
+                if (name ~ /^_/) next
+                if (loaded != path) {
+                    delete text; rows = 0
+                    while ((getline l < path) > 0) text[rows++] = l
+                    close(path); loaded = path
+                }
+                s = line; sub(/.*start:/, "", s); gsub(/[^0-9]+/, " ", s); split(s, v, " ")
+                sr = v[1]; sc = v[2]; er = v[3]; ec = v[4]
+                body = ""
+                for (r = sr; r <= er; r++) {
+                    line = text[r]
+                    if (r == er) line = substr(line, 1, ec)
+                    if (r == sr) line = substr(line, sc + 1)
+                    body = body (r > sr ? "\n" : "") line
+                }
+                body = substr(body, 2, length(body) - 2)
+                l = (pattern in lang) ? lang[pattern] : "string"
+                system("mkdir -p \"" out "/" l "\"")
+                f = out "/" l "/" (++count[l]) ".txt"
+                printf "%s\n", body > f
+                close(f)
+                printf "%s\t%s\t%d\t%d\t%s\n", l, path, sr, sc, f > (out "/index.tsv")
+            }'
+}
+
+extract queries/injections.scm "$tmp/injected"
+if [ "$list" = 1 ]; then
+    [ -f "$tmp/injected/index.tsv" ] || exit 0
+    sort -t$'\t' -k2,2 -k3,3n -k4,4n "$tmp/injected/index.tsv" |
+        while IFS=$'\t' read -r lang path row col f; do
+            printf '%s\t%d\t%d\t%s\t' "$path" $((row + 1)) $((col + 1)) "$lang"
+            cat "$f"
+        done
+    exit 0
+fi
+printf '%s\n' '(string) @string' >"$tmp/strings.scm"
+extract "$tmp/strings.scm" "$tmp/all"
+
+summary() {
+    local dir=$1
+    [ -d "$dir" ] || { echo "0 0"; return; }
+    find "$dir" -name '*.txt' | awk '{ n++ } END { printf "%d ", n }'
+    find "$dir" -name '*.txt' -exec cat {} + | wc -c | tr -d ' '
+}
+
+echo "${#files[@]} files"
+printf '%-28s %8s %10s\n' strings count bytes
+printf '%-28s %8s %10s\n' "all" $(summary "$tmp/all/string")
+for d in "$tmp"/injected/*/; do
+    [ -d "$d" ] || continue
+    printf '%-28s %8s %10s\n' "injected: $(basename "$d")" $(summary "$d")
+done
+
+echo
+printf '%-36s %10s\n' pass ms
+printf '%-36s %10s\n' "applescript parse" "$(time_ms $TS parse --quiet "${files[@]}")"
+if [ -f queries/highlights.scm ]; then
+    printf '%-36s %10s\n' "highlights query" "$(time_ms $TS query --quiet queries/highlights.scm "${files[@]}")"
+fi
+printf '%-36s %10s\n' "injections query" "$(time_ms $TS query --quiet queries/injections.scm "${files[@]}")"
+
+child_parse() {
+    local scope=$1 dir=$2 label=$3
+    [ -d "$dir" ] || return 0
+    local probe
+    probe=$(find "$dir" -name '*.txt' | head -n 1)
+    if ! $TS parse --quiet --scope "$scope" "$probe" >/dev/null 2>&1; then
+        printf '%-36s %10s\n' "$label" "skipped (no $scope)"
+        return 0
+    fi
+    local list=()
+    while IFS= read -r f; do list+=("$f"); done < <(find "$dir" -name '*.txt' | sort)
+    printf '%-36s %10s\n' "$label" "$(time_ms $TS parse --quiet --scope "$scope" "${list[@]}")"
+}
+
+child_parse source.bash "$tmp/injected/bash" "child parse: injected shell"
+child_parse source.applescript "$tmp/injected/applescript" "child parse: injected run script"
+child_parse source.bash "$tmp/all/string" "child parse: every string as shell"
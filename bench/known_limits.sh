@@ -0,0 +1,65 @@
+#!/usr/bin/env bash
+# Parse-time benchmark for broken input.
+#
+# Error recovery is the slow path in tree-sitter: a file that produces ERROR
+# nodes costs far more per byte than a clean one. The known-limits
+# quarantine is our standing sample of "broken mid-edit" scripts, so this
+# compares its median parse time against the clean real-world corpus.
+#
+#   bench/known_limits.sh              # 20 runs per file
+#   RUNS=50 bench/known_limits.sh
+#
+# Run it on the commit before and after a scanner/grammar change and diff
+# the two outputs. From the repository root, `bench/known_limits.sh >
+# bench_output.txt` keeps them out of git: .gitignore lists that file.
+
+set -euo pipefail
+cd "$(dirname "$0")/.."
+
+TS=${TS:-npx tree-sitter}
+RUNS=${RUNS:-20}
+
+# One `tree-sitter parse` per file with the path repeated RUNS times, so
+# process start-up and grammar loading are paid once rather than per run.
+# `--time` prints one line per parse: `<path>  <ms> ms  …  (ERROR …)`.
+bench_file() {
+    local f=$1 args=() i
+    for ((i = 0; i < RUNS; i++)); do args+=("$f"); done
+    $TS parse --quiet --time "${args[@]}" 2>&1 |
+        awk '{ for (i = 1; i < NF; i++) if ($(i + 1) == "ms") { print $i; break } }' |
+        sort -n |
+        awk -v f="$f" '
+            { t[n++] = $1 }
+            END {
+                if (n == 0) { printf "%-72s  (no timing output)\n", f; exit }
+                printf "%-72s  %8.3f ms\n", f, t[int((n - 1) / 2)]
+            }'
+}
+
+errors() {
+    $TS parse "$1" 2>/dev/null | grep -c 'ERROR' || true
+}
+
+bytes() {
+    wc -c <"$1" | tr -d ' '
+}
+
+report() {
+    local label=$1; shift
+    local total_bytes=0 f
+    echo "== $label"
+    for f in "$@"; do
+        bench_file "$f"
+        printf '    %s bytes, %s ERROR\n' "$(bytes "$f")" "$(errors "$f")"
+        total_bytes=$((total_bytes + $(bytes "$f")))
+    done
+    echo "   $# files, $total_bytes bytes"
+}
+
+echo "runs per file: $RUNS (median reported)"
+# shellcheck disable=SC2046  # corpus paths contain no whitespace
+report "known-limits (with errors)" \
+    $(find test/corpus/realworld/known-limits -name '*.applescript' | sort)
+# shellcheck disable=SC2046
+report "active corpus (clean)" \
+    $(find test/corpus/realworld -name '*.applescript' -not -path '*/known-limits/*' | sort)
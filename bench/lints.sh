@@ -0,0 +1,60 @@
+#!/usr/bin/env bash
+# Fused lint pass vs. one pass per rule.
+#
+# queries/lints.scm is a single query; each `; rule:` section is one rule.
+# For k = 1..K this times
+#   - fused: one `tree-sitter query` with the first k rules, and
+#   - split: k `tree-sitter query` runs, one rule each,
+# over the active corpus (repeated RUNS times per process, so start-up is
+# amortised). Fused time should grow with matches per node visited; split
+# time grows with a full tree walk per rule.
+#
+#   bench/lints.sh
+#   RUNS=20 bench/lints.sh
+
+set -euo pipefail
+cd "$(dirname "$0")/.."
+
+TS=${TS:-npx tree-sitter}
+RUNS=${RUNS:-5}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+# Split the query into one file per rule: rule_1.scm … rule_K.scm.
+awk -v dir="$tmp" '
+    /^; rule: / { n++ }
+    n > 0 { print > (dir "/rule_" n ".scm") }
+    END { print n > (dir "/count") }' queries/lints.scm
+rules=$(cat "$tmp/count")
+
+files=()
+while IFS= read -r f; do files+=("$f"); done \
+    < <(find test/corpus/realworld -name '*.applescript' -not -path '*/known-limits/*' | sort)
+args=()
+for ((i = 0; i < RUNS; i++)); do args+=("${files[@]}"); done
+
+now_ns() {
+    # `date +%N` is GNU-only; fall back to python for BSD/macOS.
+    date +%s%N 2>/dev/null | grep -v N || python3 -c 'import time; print(time.time_ns())'
+}
+
+run_query() {
+    $TS query --quiet "$1" "${args[@]}" >/dev/null 2>&1 || true
+}
+
+echo "${#files[@]} files x $RUNS runs"
+printf '%-6s %12s %12s\n' rules "fused ms" "split ms"
+: >"$tmp/fused.scm"
+for ((k = 1; k <= rules; k++)); do
+    cat "$tmp/rule_$k.scm" >>"$tmp/fused.scm"
+
+    start=$(now_ns)
+    run_query "$tmp/fused.scm"
+    fused=$((($(now_ns) - start) / 1000000))
+
+    start=$(now_ns)
+    for ((j = 1; j <= k; j++)); do run_query "$tmp/rule_$j.scm"; done
+    split=$((($(now_ns) - start) / 1000000))
+
+    printf '%-6d %12d %12d\n' "$k" "$fused" "$split"
+done
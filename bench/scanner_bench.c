@@ -0,0 +1,241 @@
+// Micro-benchmark for the external scanner.
+//
+// Drives `tree_sitter_applescript_external_scanner_scan` through an
+// in-memory mock `TSLexer`, with the `valid_symbols` set each case needs,
+// so scanner changes can be measured without the parser around them. Each
+// case is first checked against its expected result (a wrong answer fails
+// the run), then called repeatedly for at least MIN_NS.
+//
+// Reported per case:
+//   bytes     input length
+//   ns/call   wall time per scan call
+//   bytes/ns  bytes the scanner advanced or skipped over, per ns
+//
+//   make bench-scanner
+//   bench/scanner_bench [substring]    # only cases whose name contains it
+//
+// The scanner is included, not linked, so the cases can name its token
+// types and the benchmark needs nothing beyond `src/`.
+
+// clock_gettime under -std=c11.
+#define _POSIX_C_SOURCE 199309L
+
+#include "scanner.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MIN_NS 200000000ull
+
+// Mock lexer over a UTF-8 buffer. Mirrors the parts of tree-sitter's lexer
+// the scanner relies on: `lookahead` is the decoded code point (0 at EOF),
+// `skip` moves the token start, and `get_column` re-walks the current line
+// the way the real lexer does.
+typedef struct {
+    TSLexer base;
+    const char *input;
+    uint32_t length;
+    uint32_t position;
+    uint32_t lookahead_size;
+    uint32_t token_start;
+    uint32_t token_end;
+    uint64_t bytes_scanned;
+} MockLexer;
+
+static void mock_decode(MockLexer *self) {
+    if (self->position >= self->length) {
+        self->base.lookahead = 0;
+        self->lookahead_size = 0;
+        return;
+    }
+    const unsigned char *s = (const unsigned char *)self->input + self->position;
+    uint32_t left = self->length - self->position;
+    if (s[0] < 0x80 || left < 2) {
+        self->base.lookahead = s[0];
+        self->lookahead_size = 1;
+    } else if (s[0] < 0xE0 || left < 3) {
+        self->base.lookahead = ((s[0] & 0x1F) << 6) | (s[1] & 0x3F);
+        self->lookahead_size = 2;
+    } else if (s[0] < 0xF0 || left < 4) {
+        self->base.lookahead = ((s[0] & 0x0F) << 12) | ((s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+        self->lookahead_size = 3;
+    } else {
+        self->base.lookahead = ((s[0] & 0x07) << 18) | ((s[1] & 0x3F) << 12) |
+                               ((s[2] & 0x3F) << 6) | (s[3] & 0x3F);
+        self->lookahead_size = 4;
+    }
+}
+
+static void mock_advance(TSLexer *lexer, bool skip) {
+    MockLexer *self = (MockLexer *)lexer;
+    if (self->position >= self->length) return;
+    self->position += self->lookahead_size;
+    self->bytes_scanned += self->lookahead_size;
+    if (skip) self->token_start = self->position;
+    mock_decode(self);
+}
+
+static void mock_mark_end(TSLexer *lexer) {
+    MockLexer *self = (MockLexer *)lexer;
+    self->token_end = self->position;
+}
+
+static uint32_t mock_get_column(TSLexer *lexer) {
+    MockLexer *self = (MockLexer *)lexer;
+    uint32_t start = self->position;
+    while (start > 0 && self->input[start - 1] != '\n' && self->input[start - 1] != '\r') {
+        start--;
+    }
+    uint32_t column = 0;
+    for (uint32_t i = start; i < self->position; i++) {
+        // Count code points, not UTF-8 continuation bytes.
+        if (((unsigned char)self->input[i] & 0xC0) != 0x80) column++;
+    }
+    return column;
+}
+
+static bool mock_is_at_included_range_start(const TSLexer *lexer) {
+    (void)lexer;
+    return false;
+}
+
+static bool mock_eof(const TSLexer *lexer) {
+    const MockLexer *self = (const MockLexer *)lexer;
+    return self->position >= self->length;
+}
+
+static void mock_reset(MockLexer *self, const char *input, uint32_t length) {
+    self->base.advance = mock_advance;
+    self->base.mark_end = mock_mark_end;
+    self->base.get_column = mock_get_column;
+    self->base.is_at_included_range_start = mock_is_at_included_range_start;
+    self->base.eof = mock_eof;
+    self->base.result_symbol = 0;
+    self->input = input;
+    self->length = length;
+    self->position = 0;
+    self->token_start = 0;
+    self->token_end = UINT32_MAX;
+    mock_decode(self);
+}
+
+// Valid-symbol sets for the parse states the cases stand in for.
+#define TOKEN_COUNT (INLINE_MARKER + 1)
+
+static const enum TokenType STATEMENT_START[] = {
+    BLOCK_COMMENT, ALIAS_PREFIX, PIPED_IDENTIFIER, KEYWORD_HANDLER_TO, TOKEN_COUNT,
+};
+static const enum TokenType IN_EXPRESSION[] = {
+    BLOCK_COMMENT, ALIAS_PREFIX, PIPED_IDENTIFIER, TOKEN_COUNT,
+};
+static const enum TokenType AFTER_THEN[] = {
+    BLOCK_COMMENT, INLINE_MARKER, TOKEN_COUNT,
+};
+
+typedef struct {
+    const char *name;
+    char *input;
+    const enum TokenType *valid;
+    bool expect_found;
+    enum TokenType expect_symbol;
+} Case;
+
+// Concatenates `head`, `count` copies of `body` and `tail` into a new buffer.
+static char *repeat_input(const char *head, const char *body, size_t count, const char *tail) {
+    size_t head_length = strlen(head), body_length = strlen(body), tail_length = strlen(tail);
+    char *out = malloc(head_length + body_length * count + tail_length + 1);
+    if (!out) {
+        perror("malloc");
+        exit(2);
+    }
+    char *p = out;
+    memcpy(p, head, head_length);
+    p += head_length;
+    for (size_t i = 0; i < count; i++) {
+        memcpy(p, body, body_length);
+        p += body_length;
+    }
+    memcpy(p, tail, tail_length + 1);
+    return out;
+}
+
+static char *literal(const char *s) { return repeat_input(s, "", 0, ""); }
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static bool run_case(const Case *c) {
+    bool valid[TOKEN_COUNT] = {false};
+    for (const enum TokenType *t = c->valid; *t != TOKEN_COUNT; t++) valid[*t] = true;
+
+    uint32_t length = (uint32_t)strlen(c->input);
+    MockLexer lexer;
+
+    mock_reset(&lexer, c->input, length);
+    bool found = tree_sitter_applescript_external_scanner_scan(NULL, &lexer.base, valid);
+    if (found != c->expect_found || (found && lexer.base.result_symbol != c->expect_symbol)) {
+        fprintf(stderr, "FAIL: %s: got %s (symbol %u), expected %s (symbol %u)\n", c->name,
+                found ? "token" : "no token", (unsigned)lexer.base.result_symbol,
+                c->expect_found ? "token" : "no token", (unsigned)c->expect_symbol);
+        return false;
+    }
+
+    uint64_t calls = 0, scanned = 0, elapsed = 0;
+    uint64_t start = now_ns();
+    while (elapsed < MIN_NS) {
+        for (int i = 0; i < 64; i++) {
+            mock_reset(&lexer, c->input, length);
+            lexer.bytes_scanned = 0;
+            tree_sitter_applescript_external_scanner_scan(NULL, &lexer.base, valid);
+            scanned += lexer.bytes_scanned;
+        }
+        calls += 64;
+        elapsed = now_ns() - start;
+    }
+
+    printf("%-36s %9u %12.1f %10.3f\n", c->name, length, (double)elapsed / (double)calls,
+           (double)scanned / (double)elapsed);
+    return true;
+}
+
+int main(int argc, char **argv) {
+    const char *filter = argc > 1 ? argv[1] : NULL;
+
+    Case cases[] = {
+        // Representative: what the scanner sees at ordinary positions.
+        {"block comment", literal("(* Created by Script Editor; \"*)\" in a string *)\nset x to 1"),
+         STATEMENT_START, true, BLOCK_COMMENT},
+        {"alias prefix", literal("alias \"Macintosh HD:Users:me:\""), IN_EXPRESSION, true, ALIAS_PREFIX},
+        {"alias of (rejected)", literal("alias of theItem"), IN_EXPRESSION, false, 0},
+        {"piped identifier", literal("|my variable| to 5"), IN_EXPRESSION, true, PIPED_IDENTIFIER},
+        {"handler to at column 0", literal("to splitString(s, d)\n"), STATEMENT_START, true, KEYWORD_HANDLER_TO},
+        {"plain statement word", literal("\n\tset x to 5\n"), STATEMENT_START, false, 0},
+        {"inline marker", literal(" return x"), AFTER_THEN, true, INLINE_MARKER},
+
+        // Adversarial: inputs that make a routine walk far or re-walk.
+        {"unclosed nested comment x1000", repeat_input("", "(* ", 1000, ""), STATEMENT_START, false, 0},
+        {"block comment, 16k quoted *)", repeat_input("(* ", "\"x*)\" ", 16384, "*)"),
+         STATEMENT_START, true, BLOCK_COMMENT},
+        {"unterminated piped identifier", repeat_input("|", "a", 65536, ""), IN_EXPRESSION, false, 0},
+        {"alias, 16k continued lines, of", repeat_input("alias", " ¬\n", 16384, "of x"), IN_EXPRESSION, false, 0},
+        {"to after 64k spaces", repeat_input("", " ", 65536, "to x"), STATEMENT_START, false, 0},
+        {"then, 16k continued lines", repeat_input("", " ¬\n  ", 16384, "return x"), AFTER_THEN, true,
+         INLINE_MARKER},
+        {"64k blank lines, comment", repeat_input("", "\n", 65536, "(* c *)"), STATEMENT_START, true,
+         BLOCK_COMMENT},
+    };
+
+    int failed = 0;
+    printf("%-36s %9s %12s %10s\n", "case", "bytes", "ns/call", "bytes/ns");
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        if (filter && !strstr(cases[i].name, filter)) continue;
+        if (!run_case(&cases[i])) failed++;
+    }
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) free(cases[i].input);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,58 @@
+#!/usr/bin/env bash
+# script/shell_taint on one generated script of HANDLERS handlers. Each
+# handler assigns a chain of CHAIN variables, each built from the one
+# before, inside an `if`/`else`, a `repeat` and a `try`, and ends with two
+# `do shell script` calls: one on the chain (unsafe, the parameter is at
+# its root) and one on a variable reassigned to its quoted form. Prints
+# the time and handlers per second; both should stay flat in CHAIN per
+# assignment and in HANDLERS per handler, since every handler is solved on
+# its own and the worklist visits each (statement, assignment) pair once.
+#
+#   bench/shell_taint.sh                      # HANDLERS = 100 1000, CHAIN = 10 50
+#   HANDLERS="5000" CHAIN="200" bench/shell_taint.sh
+
+set -euo pipefail
+cd "$(dirname "$0")/.."
+
+export TS=${TS:-npx tree-sitter}
+HANDLERS=${HANDLERS:-100 1000}
+CHAIN=${CHAIN:-10 50}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+gen() {
+    awk -v n="$1" -v chain="$2" 'BEGIN {
+        for (h = 0; h < n; h++) {
+            printf "on h%d(x)\n", h
+            printf "\tset v0 to x\n"
+            for (i = 1; i < chain; i++) {
+                if (i % 4 == 1) printf "\tif x then\n\t\tset v%d to \"a\" & v%d\n\telse\n\t\tset v%d to v%d & \"b\"\n\tend if\n", i, i - 1, i, i - 1
+                else if (i % 4 == 2) printf "\trepeat with i in v%d\n\t\tset v%d to v%d & i\n\tend repeat\n", i - 1, i, i - 1
+                else if (i % 4 == 3) printf "\ttry\n\t\tset v%d to (v%d as text)\n\ton error\n\t\tset v%d to \"\"\n\tend try\n", i, i - 1, i
+                else printf "\tset v%d to v%d\n", i, i - 1
+            }
+            printf "\tdo shell script \"echo \" & v%d\n", chain - 1
+            printf "\tset p to POSIX path of x\n\tset p to quoted form of p\n"
+            printf "\tdo shell script \"ls \" & p\n"
+            printf "end h%d\n\n", h
+        }
+    }' >"$3"
+}
+
+now_ns() {
+    # `date +%N` is GNU-only; fall back to python for BSD/macOS.
+    date +%s%N 2>/dev/null | grep -v N || python3 -c 'import time; print(time.time_ns())'
+}
+
+printf '%-9s %6s %9s %8s %13s\n' handlers chain reports ms handlers/sec
+for n in $HANDLERS; do
+    for c in $CHAIN; do
+        f=$tmp/h${n}_c$c.applescript
+        gen "$n" "$c" "$f"
+        start=$(now_ns)
+        reports=$(script/shell_taint "$f" 2>/dev/null | wc -l | tr -d ' ')
+        ms=$((($(now_ns) - start) / 1000000))
+        [ "$ms" -gt 0 ] || ms=1
+        printf '%-9s %6s %9s %8s %13s\n' "$n" "$c" "$reports" "$ms" $((n * 1000 / ms))
+    done
+done
@@ -0,0 +1,46 @@
+#!/usr/bin/env bash
+# Throughput of the validation gate vs. a full parse + tree walk.
+#
+# `script/validate` runs `tree-sitter parse --quiet`, which skips printing
+# the tree and only walks into subtrees flagged `has_error`. The baseline
+# is plain `tree-sitter parse`, which walks and prints every node — what a
+# gate built on "dump the tree, grep for ERROR" costs.
+#
+#   bench/validate.sh            # 10 passes over the active corpus
+#   RUNS=50 bench/validate.sh
+
+set -euo pipefail
+cd "$(dirname "$0")/.."
+
+TS=${TS:-npx tree-sitter}
+RUNS=${RUNS:-10}
+
+files=()
+while IFS= read -r f; do files+=("$f"); done \
+    < <(find test/corpus/realworld -name '*.applescript' -not -path '*/known-limits/*' | sort)
+
+args=()
+for ((i = 0; i < RUNS; i++)); do args+=("${files[@]}"); done
+
+bytes=$(cat "${files[@]}" | wc -c | tr -d ' ')
+total=$((bytes * RUNS))
+
+now_ns() {
+    # `date +%N` is GNU-only; fall back to python for BSD/macOS.
+    date +%s%N 2>/dev/null | grep -v N || python3 -c 'import time; print(time.time_ns())'
+}
+
+measure() {
+    local label=$1; shift
+    local start end ms
+    start=$(now_ns)
+    "$@" >/dev/null 2>&1 || true
+    end=$(now_ns)
+    ms=$(((end - start) / 1000000))
+    awk -v l="$label" -v ms="$ms" -v b="$total" \
+        'BEGIN { printf "%-28s %8d ms  %10.1f KiB/s\n", l, ms, (b / 1024) / (ms > 0 ? ms / 1000 : 1) }'
+}
+
+echo "${#files[@]} files x $RUNS runs, $total bytes"
+measure "parse + full tree walk" $TS parse "${args[@]}"
+measure "validate (--quiet)" $TS parse --quiet "${args[@]}"
@@ -0,0 +1,101 @@
+#!/usr/bin/env bash
+# Viewport-scoped vs. whole-file highlighting on large generated scripts.
+#
+# For each size N (lines), generates a script of handlers and `tell` blocks,
+# builds its top-level block offset table with script/block_offsets, and
+# picks a viewport of VIEW lines in the middle of the file. Then times
+#   - parse only (`parse --quiet`), the floor every CLI run pays;
+#   - queries/highlights.scm over the whole file;
+#   - the same query with `--byte-range` set to the blocks overlapping the
+#     viewport (lines outside any block count as their own range).
+# The "query" columns subtract the parse floor, which is what an editor
+# holding a live tree pays per paint. The viewport column should stay flat
+# as N grows; the whole-file one grows with N.
+#
+#   bench/viewport.sh                   # N = 1000 10000 100000, VIEW = 60
+#   SIZES="500000" VIEW=120 bench/viewport.sh
+
+set -euo pipefail
+cd "$(dirname "$0")/.."
+
+TS=${TS:-npx tree-sitter}
+SIZES=${SIZES:-1000 10000 100000}
+VIEW=${VIEW:-60}
+RUNS=${RUNS:-5}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+# Roughly N lines: 12-line handlers and 6-line tell blocks, alternating.
+gen() {
+    awk -v n="$1" 'BEGIN {
+        for (i = 0; lines < n; i++) {
+            printf "on handler%d(theList, theName)\n", i
+            print "\tset total to 0"
+            print "\trepeat with x in theList"
+            print "\t\tset total to total + (x as integer) * 2"
+            print "\tend repeat"
+            print "\tif total > 100 then"
+            print "\t\tdisplay dialog \"Big: \" & total with title theName"
+            print "\telse"
+            print "\t\tlog \"small\""
+            print "\tend if"
+            print "\treturn {total:total, name:theName}"
+            printf "end handler%d\n", i
+            print "tell application \"Finder\""
+            print "\tset f to name of every file of desktop"
+            printf "\tmy handler%d(f, \"x\")\n", i
+            print "\tactivate"
+            print "end tell"
+            print ""
+            lines += 18
+        }
+    }'
+}
+
+now_ns() {
+    # `date +%N` is GNU-only; fall back to python for BSD/macOS.
+    date +%s%N 2>/dev/null | grep -v N || python3 -c 'import time; print(time.time_ns())'
+}
+
+# Median wall ms of RUNS runs of the given command.
+median_ms() {
+    local i start
+    for ((i = 0; i < RUNS; i++)); do
+        start=$(now_ns)
+        "$@" >/dev/null 2>&1 || true
+        echo $((($(now_ns) - start) / 1000000))
+    done | sort -n | awk '{ v[NR] = $1 } END { print v[int((NR + 1) / 2)] }'
+}
+
+printf '%-8s %-14s %10s %12s %14s\n' lines "viewport bytes" "parse ms" "full query" "viewport query"
+for n in $SIZES; do
+    f=$tmp/gen_$n.applescript
+    gen "$n" >"$f"
+    script/block_offsets "$f" >"$tmp/blocks.tsv"
+
+    total=$(wc -l <"$f" | tr -d ' ')
+    top=$((total / 2))
+    bottom=$((top + VIEW))
+
+    # Viewport rows → byte range, widened to every block it overlaps.
+    range=$(LC_ALL=C awk -v top="$top" -v bottom="$bottom" -v blocks="$tmp/blocks.tsv" '
+        { if (NR - 1 == top) lo = offset; offset += length($0) + 1; if (NR == bottom) hi = offset }
+        END {
+            if (hi == "") hi = offset
+            while ((getline b < blocks) > 0) {
+                split(b, v, "\t")
+                if (v[4] >= top && v[3] < bottom) {
+                    if (v[1] < lo) lo = v[1]
+                    if (v[2] > hi) hi = v[2]
+                }
+            }
+            printf "%d:%d\n", lo, hi
+        }' "$f")
+
+    parse=$(median_ms $TS parse --quiet "$f")
+    full=$(median_ms $TS query --quiet queries/highlights.scm "$f")
+    view=$(median_ms $TS query --quiet --byte-range "$range" queries/highlights.scm "$f")
+
+    printf '%-8s %-14s %10s %12s %14s\n' "$total" "$((${range#*:} - ${range%:*}))" \
+        "$parse" "$((full - parse))" "$((view - parse))"
+done
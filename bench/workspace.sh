@@ -0,0 +1,118 @@
+#!/usr/bin/env bash
+# What one document costs a host that keeps many scripts open.
+#
+# A workspace host (an editor with hundreds of scripts open) shares the one
+# language object and keeps a tree per document. Under a memory budget it
+# can evict a cold tree and keep only the text: tree-sitter has no compact
+# tree serialization, and re-parsing the text is the restore path. For each
+# file this reports
+#   - bytes of source;
+#   - parse ms (`--quiet --time`), i.e. the cost of restoring an evicted
+#     tree, or of the first parse;
+#   - tree KiB: what keeping its tree resident costs. One small tree is
+#     lost in the noise of a process's RSS, so the file is repeated up to
+#     BIG bytes (default 8 MiB) and parsed by the CLI binary itself (not
+#     the `npx`/npm node wrapper, whose RSS would be measured instead):
+#     peak RSS minus that of an empty file and minus the source the CLI
+#     holds, divided by the number of copies;
+# then the median, p95 and max of each column and the totals, which are
+# what an eviction budget and a reparse scheduler are sized from.
+#
+# The binary is TS_BIN, else the one the npm package downloads
+# (node_modules/tree-sitter-cli/tree-sitter), else a native `tree-sitter`
+# on PATH; without one the column is `?`.
+#
+#   bench/workspace.sh
+#   bench/workspace.sh path/to/scripts/
+#   TS_BIN=~/.cargo/bin/tree-sitter BIG=33554432 bench/workspace.sh
+
+set -euo pipefail
+. "$(dirname "$0")/../script/lib.sh"
+
+TS=${TS:-npx tree-sitter}
+BIG=${BIG:-8388608}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+files=()
+if [ $# -eq 0 ]; then
+    set -- test/corpus/realworld
+fi
+for p in "$@"; do
+    p=$(from_caller "$p")
+    if [ -d "$p" ]; then
+        while IFS= read -r f; do files+=("$f"); done \
+            < <(find "$p" -name '*.applescript' -not -path '*/known-limits/*' | sort)
+    else
+        files+=("$p")
+    fi
+done
+
+peak_rss_kb() {
+    if /usr/bin/time -v true >/dev/null 2>&1; then
+        /usr/bin/time -v "$@" 2>&1 >/dev/null | awk '/Maximum resident/ { print $NF }'
+    elif /usr/bin/time -l true >/dev/null 2>&1; then
+        # BSD/macOS: -l reports bytes.
+        /usr/bin/time -l "$@" 2>&1 >/dev/null | awk '/maximum resident/ { print int($1 / 1024) }'
+    fi
+}
+
+# A native executable, not a `#!` script.
+native() { [ -n "$1" ] && [ -x "$1" ] && [ "$(head -c 2 "$1")" != '#!' ]; }
+bin=${TS_BIN:-}
+if [ -z "$bin" ]; then
+    for c in node_modules/tree-sitter-cli/tree-sitter "$(command -v tree-sitter || true)"; do
+        if native "$c"; then bin=$c; break; fi
+    done
+fi
+[ -n "$bin" ] || echo "no tree-sitter binary found (set TS_BIN); tree KiB is not measured" >&2
+
+base=
+if [ -n "$bin" ]; then
+    : >"$tmp/empty.applescript"
+    base=$(peak_rss_kb "$bin" parse --quiet "$tmp/empty.applescript")
+fi
+
+printf '%-40s %10s %10s %10s\n' file bytes "parse ms" "tree KiB"
+for f in "${files[@]}"; do
+    bytes=$(wc -c <"$f" | tr -d ' ')
+    ms=$($TS parse --quiet --time "$f" 2>&1 |
+        awk '{ for (i = 1; i < NF; i++) if ($(i + 1) == "ms") { print $i; exit } }')
+    kib=?
+    if [ -n "${base:-}" ]; then
+        copies=$((BIG / (bytes > 0 ? bytes : 1)))
+        [ "$copies" -ge 1 ] || copies=1
+        awk -v n="$copies" '{ line[NR] = $0 }
+            END { for (i = 0; i < n; i++) { for (j = 1; j <= NR; j++) print line[j]; print "" } }' \
+            "$f" >"$tmp/big.applescript"
+        big=$(wc -c <"$tmp/big.applescript" | tr -d ' ')
+        rss=$(peak_rss_kb "$bin" parse --quiet "$tmp/big.applescript")
+        if [ -n "${rss:-}" ]; then
+            kib=$(((rss - base - big / 1024) / copies))
+            [ "$kib" -ge 0 ] || kib=0
+        fi
+    fi
+    name=${f#"$root"/}
+    [ ${#name} -le 40 ] || name=...${name: -37}
+    printf '%-40s %10s %10s %10s\n' "$name" "$bytes" "${ms:-?}" "$kib" | tee -a "$tmp/rows.txt"
+done
+
+echo
+# Columns 2..4 of the rows: median, p95 and max, then the total.
+for stat in median p95 max total; do
+    printf '%-40s' "$stat"
+    for col in 2 3 4; do
+        awk -v col="$col" '$col != "?" { print $col }' "$tmp/rows.txt" | sort -g |
+            awk -v stat="$stat" '
+                { v[NR] = $1; sum += $1 }
+                END {
+                    if (NR == 0) { printf " %10s", "?"; exit }
+                    if (stat == "median") x = v[int((NR + 1) / 2)]
+                    else if (stat == "p95") x = v[int((NR * 95 + 99) / 100)]
+                    else if (stat == "max") x = v[NR]
+                    else x = sum
+                    printf " %10s", x
+                }'
+    done
+    printf '\n'
+done
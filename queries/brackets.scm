@@ -0,0 +1,26 @@
+; Matching pairs for AppleScript (Zed convention: `@open` / `@close`).
+;
+; Each block's opening keyword (`tell`, `if`, `repeat`, `on`/`to`, …) is
+; paired with the `end` that closes it — the trailing name (`end tell`,
+; `end splitString`) is optional and not part of the pair. The opening
+; keyword is always the block's `keyword` field, so both ends of a pair are
+; found by one pattern per block type, without walking the block body.
+;
+; script/block_index builds the same pairs into a sorted offset table.
+
+(tell_block keyword: (_) @open (keyword_end) @close)
+(if_block keyword: (_) @open (keyword_end) @close)
+(repeat_block keyword: (_) @open (keyword_end) @close)
+(try_block keyword: (_) @open (keyword_end) @close)
+(considering_block keyword: (_) @open (keyword_end) @close)
+(ignoring_block keyword: (_) @open (keyword_end) @close)
+(timeout_block keyword: (_) @open (keyword_end) @close)
+(transaction_block keyword: (_) @open (keyword_end) @close)
+(using_terms_block keyword: (_) @open (keyword_end) @close)
+(script_block keyword: (_) @open (keyword_end) @close)
+(handler_definition keyword: (_) @open (keyword_end) @close)
+(handler_definition keyword: (_) @open (implicit_run_end) @close)
+(objc_handler_definition keyword: (_) @open (keyword_end) @close)
+
+("(" @open ")" @close)
+("{" @open "}" @close)
@@ -0,0 +1,30 @@
+; Folding ranges for AppleScript.
+;
+; Every `… end` block folds as a whole, from its opening keyword to its
+; `end` line. `else`/`else if` arms and `on error` handlers fold on their
+; own inside their block. Multi-line block comments, lists and records fold
+; too.
+;
+; The captures are per node, so a host evaluates this with a cursor limited
+; to the changed or visible byte range instead of re-walking the tree.
+
+[
+  (tell_block)
+  (if_block)
+  (repeat_block)
+  (try_block)
+  (considering_block)
+  (ignoring_block)
+  (timeout_block)
+  (transaction_block)
+  (using_terms_block)
+  (script_block)
+  (handler_definition)
+  (objc_handler_definition)
+  (else_if_clause)
+  (else_clause)
+  (error_handler)
+  (block_comment)
+  (list)
+  (record)
+] @fold
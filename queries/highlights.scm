@@ -0,0 +1,183 @@
+; Syntax highlighting for AppleScript.
+;
+; tree-sitter-highlight gives a node the capture of the FIRST pattern that
+; matches it, so specific patterns (handler names, parameters, calls) come
+; before the catch-all `(identifier) @variable` at the end.
+;
+; Keywords that the grammar builds with `token(ci(...))` inline (`of`,
+; `given`, `whose`, `seconds`, …) are anonymous regex tokens and cannot be
+; captured; only the named `keyword_*` nodes and literal punctuation can.
+
+; Comments
+(comment) @comment
+(block_comment) @comment
+
+; Handlers
+(handler_definition
+  name: [(identifier) (command_name)] @function)
+(handler_definition
+  name: (folder_action_event) @function.builtin)
+; An ObjC handler's selector words (in the header and after `end`) are
+; the identifiers followed by `:`; its parameters follow a `:` instead.
+(objc_handler_definition
+  (identifier) @function
+  .
+  ":")
+(objc_handler_definition
+  ":"
+  .
+  (identifier) @variable.parameter)
+; A bare parameter (`on open theItems`) is the identifier right after the
+; handler name.
+(handler_definition
+  name: (_)
+  .
+  (identifier) @variable.parameter)
+(parameter_list
+  (identifier) @variable.parameter)
+(labeled_parameter
+  label: (identifier) @label
+  name: (identifier) @variable.parameter)
+(error_parameters
+  (identifier) @variable.parameter)
+
+; Calls
+(handler_call
+  . [(identifier) (piped_identifier)] @function.call)
+(bare_objc_call
+  (identifier) @function.method.call
+  .
+  ":")
+(objc_selector_call
+  (identifier) @function.method.call
+  .
+  ":")
+(command_call
+  command: (command_name) @function.builtin)
+(command_parameter
+  name: (parameter_name) @label)
+(command_flag) @label
+
+; Definitions
+(property_declaration
+  name: (identifier) @property)
+(script_block
+  name: (identifier) @type)
+
+; Keywords
+[
+  (keyword_on)
+  (keyword_handler_to)
+] @keyword.function
+
+[
+  (keyword_end)
+  (keyword_script)
+  (keyword_tell)
+  (keyword_to)
+  (keyword_considering)
+  (keyword_ignoring)
+  (keyword_with_timeout)
+  (keyword_with_transaction)
+  (keyword_using_terms_from)
+  (keyword_use)
+  (keyword_property)
+  (keyword_global)
+  (keyword_local)
+  (keyword_set)
+  (keyword_copy)
+  (keyword_log)
+  (keyword_my)
+  (keyword_application)
+  (implicit_run_end)
+  (use_importing_clause)
+  (the_keyword)
+] @keyword
+
+[
+  (keyword_if)
+  (keyword_then)
+  (keyword_else_if)
+  (keyword_else)
+] @keyword.conditional
+
+(keyword_repeat) @keyword.repeat
+
+[
+  (keyword_return)
+  (keyword_exit)
+  (keyword_continue)
+] @keyword.return
+
+[
+  (keyword_try)
+  (keyword_on_error)
+  (keyword_error)
+] @keyword.exception
+
+; Operators
+[
+  (comparison_operator)
+  (logical_operator)
+  (additive_operator)
+  (multiplicative_operator)
+  (unary_operator)
+  (range_operator)
+  "&"
+  "^"
+] @operator
+
+(possessive) @punctuation.delimiter
+
+[
+  ","
+  ":"
+] @punctuation.delimiter
+
+[
+  "("
+  ")"
+  "{"
+  "}"
+] @punctuation.bracket
+
+; Literals
+(string) @string
+(date_literal) @string.special
+(raw_data) @string.special
+(number) @number
+(boolean) @boolean
+[
+  (missing_value)
+  (null_value)
+  (applescript_constant)
+] @constant.builtin
+
+; Built-in references and types
+[
+  (me_reference)
+  (it_reference)
+  (its_reference)
+  (result_reference)
+  (current_application)
+  (current_date)
+] @variable.builtin
+
+(type_specifier) @type.builtin
+(element_type) @type
+[
+  (specifier_prefix)
+  (relative_position)
+  (text_attribute)
+] @keyword.modifier
+
+(property_reference
+  (compound_name) @property)
+(possessive_expression
+  (compound_name) @property)
+(record_entry
+  (compound_name) @property)
+
+; Identifiers
+(piped_identifier) @variable
+(identifier) @variable
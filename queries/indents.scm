@@ -0,0 +1,32 @@
+; Indentation for AppleScript blocks.
+;
+; Captures follow Zed's convention: `@indent` marks a node whose inner
+; lines are indented one level, `@end` marks the node that closes that
+; region. Editors evaluate this per line, so re-indenting an edited range
+; only needs the tree for that range — no re-lex of the whole file.
+;
+; `else`, `else if`, `on error` and `but ignoring`-style continuation lines
+; sit inside their block's region; editors outdent them with a
+; decrease-indent pattern on the line (`^\s*(else|on\s+error)\b`).
+
+; Blocks closed by `end [name]`.
+(tell_block (keyword_end) @end) @indent
+(if_block (keyword_end) @end) @indent
+(repeat_block (keyword_end) @end) @indent
+(try_block (keyword_end) @end) @indent
+(considering_block (keyword_end) @end) @indent
+(ignoring_block (keyword_end) @end) @indent
+(timeout_block (keyword_end) @end) @indent
+(transaction_block (keyword_end) @end) @indent
+(using_terms_block (keyword_end) @end) @indent
+(script_block (keyword_end) @end) @indent
+(handler_definition (keyword_end) @end) @indent
+(handler_definition (implicit_run_end) @end) @indent
+(objc_handler_definition (keyword_end) @end) @indent
+
+; Bracketed literals and argument lists that span lines.
+(list "}" @end) @indent
+(record "}" @end) @indent
+(parenthesized_expression ")" @end) @indent
+(parameter_list ")" @end) @indent
+(handler_call ")" @end) @indent
@@ -0,0 +1,72 @@
+; Language injections for AppleScript.
+;
+; Only the string literals that are really code in another language are
+; injected: the argument of `do shell script` (shell) and of `run script`
+; (AppleScript). Every other `string` stays a plain string, so a host parses
+; a child language for exactly these nodes and nothing else.
+;
+; A `string` is a single token that includes its quotes. `#offset!` trims
+; them for hosts that support it (Neovim); elsewhere the shell grammar sees
+; one double-quoted word, which still highlights as a string.
+;
+; When the command is built by concatenation (`"ls " & quoted form of p`),
+; each literal piece is injected on its own. The pieces are not combined,
+; since `injection.combined` would merge every `do shell script` in the
+; file into one shell document. `&` is left-associative, so the pieces sit
+; at increasing depth down the left spine of the argument, and there is one
+; pattern per depth: a command line of up to five operands is covered.
+;
+; `run script … in "JavaScript"` is still injected as AppleScript; a query
+; can't condition one pattern on another parameter's absence.
+
+((command_call
+  command: (command_name) @_command
+  argument: (string) @injection.content)
+  (#match? @_command "^(?i)do\\s+shell\\s+script$")
+  (#offset! @injection.content 0 1 0 -1)
+  (#set! injection.language "bash"))
+
+((command_call
+  command: (command_name) @_command
+  argument: (concatenation
+    (string) @injection.content))
+  (#match? @_command "^(?i)do\\s+shell\\s+script$")
+  (#offset! @injection.content 0 1 0 -1)
+  (#set! injection.language "bash"))
+
+((command_call
+  command: (command_name) @_command
+  argument: (concatenation
+    (concatenation
+      (string) @injection.content)))
+  (#match? @_command "^(?i)do\\s+shell\\s+script$")
+  (#offset! @injection.content 0 1 0 -1)
+  (#set! injection.language "bash"))
+
+((command_call
+  command: (command_name) @_command
+  argument: (concatenation
+    (concatenation
+      (concatenation
+        (string) @injection.content))))
+  (#match? @_command "^(?i)do\\s+shell\\s+script$")
+  (#offset! @injection.content 0 1 0 -1)
+  (#set! injection.language "bash"))
+
+((command_call
+  command: (command_name) @_command
+  argument: (concatenation
+    (concatenation
+      (concatenation
+        (concatenation
+          (string) @injection.content)))))
+  (#match? @_command "^(?i)do\\s+shell\\s+script$")
+  (#offset! @injection.content 0 1 0 -1)
+  (#set! injection.language "bash"))
+
+((command_call
+  command: (command_name) @_command
+  argument: (string) @injection.content)
+  (#match? @_command "^(?i)run\\s+script$")
+  (#offset! @injection.content 0 1 0 -1)
+  (#set! injection.language "applescript"))
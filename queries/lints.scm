@@ -0,0 +1,127 @@
+; Lint rules for AppleScript, as ONE query.
+;
+; Every rule is a pattern in this file, so a host runs all of them in a
+; single QueryCursor traversal: the cursor visits each node once and checks
+; it only against the patterns whose root node kind matches. Adding a rule
+; costs a little per matching node, not another walk of the tree — which is
+; what a dozen separate query files would cost.
+;
+; Conventions:
+;   - each rule starts with a `; rule: <id>` line (bench/lints.sh splits on
+;     these to compare against one-query-per-rule);
+;   - the reported node is captured as `@lint.<id>`;
+;   - helper captures start with `_` and are only used by predicates.
+;
+; Rules that need binding information don't fit a query: `unused-local` is
+; script/unused_locals, which follows the scopes of `locals.scm`.
+
+; rule: missing-end
+; A block whose closing `end` was synthesised by error recovery. MISSING
+; nodes are zero-width, so their text is empty.
+([
+  (tell_block (keyword_end) @lint.missing-end)
+  (if_block (keyword_end) @lint.missing-end)
+  (repeat_block (keyword_end) @lint.missing-end)
+  (try_block (keyword_end) @lint.missing-end)
+  (considering_block (keyword_end) @lint.missing-end)
+  (ignoring_block (keyword_end) @lint.missing-end)
+  (timeout_block (keyword_end) @lint.missing-end)
+  (transaction_block (keyword_end) @lint.missing-end)
+  (using_terms_block (keyword_end) @lint.missing-end)
+  (script_block (keyword_end) @lint.missing-end)
+  (handler_definition (keyword_end) @lint.missing-end)
+  (objc_handler_definition (keyword_end) @lint.missing-end)
+]
+  (#eq? @lint.missing-end ""))
+
+; rule: on-error-without-parameters
+; `on error` that discards the message and number. The parameters are on
+; the `on error` line, so a handler without them has only a comment or the
+; end of the line after the keyword.
+((error_handler
+  (keyword_on_error) @lint.on-error-without-parameters) @_handler
+  (#match? @_handler "^(?i)on[ \\t]+error[ \\t]*(--|#|\\r|\\n|$)"))
+
+; rule: empty-error-handler
+; `on error` with no statements: the failure is swallowed silently.
+(error_handler
+  (keyword_on_error) @lint.empty-error-handler
+  .)
+
+(error_handler
+  (keyword_on_error)
+  .
+  (error_parameters) @lint.empty-error-handler
+  .)
+
+; rule: do-shell-script-unquoted
+; A variable spliced into a `do shell script` command line without `quoted
+; form of`. `&` is left-associative, so the operands sit at increasing
+; depth down the left spine of the argument; there is one pattern per
+; depth, covering command lines of up to five operands. script/shell_taint
+; follows variables back through their assignments instead.
+(command_call
+  command: (command_name) @_cmd
+  argument: (concatenation
+    [
+      (identifier)
+      (piped_identifier)
+      (possessive_expression)
+      (property_reference
+        (compound_name) @_prop
+        (#not-match? @_prop "^(?i)quoted\\s+form$"))
+    ] @lint.do-shell-script-unquoted)
+  (#match? @_cmd "^(?i)do\\s+shell\\s+script$"))
+
+(command_call
+  command: (command_name) @_cmd
+  argument: (concatenation
+    (concatenation
+      [
+        (identifier)
+        (piped_identifier)
+        (possessive_expression)
+        (property_reference
+          (compound_name) @_prop
+          (#not-match? @_prop "^(?i)quoted\\s+form$"))
+      ] @lint.do-shell-script-unquoted))
+  (#match? @_cmd "^(?i)do\\s+shell\\s+script$"))
+
+(command_call
+  command: (command_name) @_cmd
+  argument: (concatenation
+    (concatenation
+      (concatenation
+        [
+          (identifier)
+          (piped_identifier)
+          (possessive_expression)
+          (property_reference
+            (compound_name) @_prop
+            (#not-match? @_prop "^(?i)quoted\\s+form$"))
+        ] @lint.do-shell-script-unquoted)))
+  (#match? @_cmd "^(?i)do\\s+shell\\s+script$"))
+
+(command_call
+  command: (command_name) @_cmd
+  argument: (concatenation
+    (concatenation
+      (concatenation
+        (concatenation
+          [
+            (identifier)
+            (piped_identifier)
+            (possessive_expression)
+            (property_reference
+              (compound_name) @_prop
+              (#not-match? @_prop "^(?i)quoted\\s+form$"))
+          ] @lint.do-shell-script-unquoted))))
+  (#match? @_cmd "^(?i)do\\s+shell\\s+script$"))
+
+(command_call
+  command: (command_name) @_cmd
+  argument: [
+    (identifier)
+    (piped_identifier)
+  ] @lint.do-shell-script-unquoted
+  (#match? @_cmd "^(?i)do\\s+shell\\s+script$"))
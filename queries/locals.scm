@@ -0,0 +1,94 @@
+; Scopes and bindings for AppleScript identifiers.
+;
+; Uses tree-sitter-highlight's `@local.*` captures, which resolve every
+; reference to its nearest enclosing definition in a single pass over the
+; tree. Names are matched by text (AppleScript identifiers are
+; case-insensitive, so hosts that need exact semantics should compare
+; case-folded text).
+;
+; Scopes are the script itself, `script` objects and handlers. A handler
+; scope still sees the enclosing script's definitions, which is right for
+; `property` and `global` names; a plain top-level `set x` is technically
+; local to the implicit run handler, which this query doesn't model.
+
+; Scopes
+(source_file) @local.scope
+(script_block) @local.scope
+(handler_definition) @local.scope
+(objc_handler_definition) @local.scope
+
+; Declarations
+(property_declaration
+  name: [(identifier) (piped_identifier)] @local.definition)
+
+(global_declaration
+  [(identifier) (piped_identifier)] @local.definition)
+
+(local_declaration
+  [(identifier) (piped_identifier)] @local.definition)
+
+; Handler parameters: `on f(a, b)`, `on open theItems`, `on run {a, b}`,
+; `to f given label:name`, Folder Action `after receiving items`, and
+; ObjC-style `on split:s by:d`. A bare or list parameter is the first named
+; node after the handler name, which is where the parser puts it.
+(parameter_list
+  [(identifier) (piped_identifier)] @local.definition)
+
+(handler_definition
+  name: (_)
+  .
+  (identifier) @local.definition)
+
+(handler_definition
+  name: (_)
+  .
+  (list
+    (identifier) @local.definition))
+
+(labeled_parameter
+  name: [(identifier) (piped_identifier)] @local.definition)
+
+(folder_action_param
+  (identifier) @local.definition)
+
+; An ObjC parameter is the identifier right after a `:`. The `end` clause
+; repeats the selector words, and its last word is also preceded by a `:`;
+; a parameter is always followed by a named node (the next selector word,
+; the body or `end`), the last word of the `end` clause never is.
+(objc_handler_definition
+  ":"
+  .
+  (identifier) @local.definition
+  .
+  (_))
+
+; `repeat with i from …` / `repeat with x in …`. `with` is a hidden token,
+; so the block's text tells a loop variable from `repeat n times` or
+; `repeat while flag`.
+((repeat_block
+  (keyword_repeat)
+  .
+  (identifier) @local.definition) @_repeat
+  (#match? @_repeat "^[Rr][Ee][Pp][Ee][Aa][Tt][ \t]+[Ww][Ii][Tt][Hh][ \t]"))
+
+; `on error errMsg number errNum`
+(error_parameters
+  [(identifier) (piped_identifier)] @local.definition)
+
+; Assignment to a bare name introduces it in the current scope.
+(set_statement
+  variable: [(identifier) (piped_identifier)] @local.definition)
+
+(copy_statement
+  variable: [(identifier) (piped_identifier)] @local.definition)
+
+; Handler names are visible to the enclosing scope, not just their own
+; body (`scope "parent"` is honoured by Neovim; tree-sitter-highlight
+; ignores it and binds the name inside the handler).
+((handler_definition
+  name: (identifier) @local.definition.function)
+  (#set! definition.function.scope "parent"))
+
+; References
+(identifier) @local.reference
+(piped_identifier) @local.reference
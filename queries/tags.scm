@@ -0,0 +1,35 @@
+; Tags (definitions and references) for AppleScript, in the code-navigation
+; convention: `@name` is the symbol, the other capture the whole node.
+;
+; Handlers are defined by `on`/`to` and called as `name(…)` (also through
+; `my name(…)`, which wraps the same `handler_call`) or by selector, bare
+; (`sortList:x`) or with a receiver (`its sortList:x`). An ObjC handler and
+; its calls are tagged by the first selector word, so `on split:s by:d` and
+; `my split:s by:d` carry the same `@name`.
+;
+; `on open …`, `on quit` and the other command-word handlers are event
+; entry points called by the system, not by name, and are not tagged.
+
+(handler_definition
+  name: (identifier) @name) @definition.function
+
+(objc_handler_definition
+  keyword: (_)
+  .
+  (identifier) @name) @definition.method
+
+(script_block
+  name: (identifier) @name) @definition.class
+
+(handler_call
+  .
+  [(identifier) (piped_identifier)] @name) @reference.call
+
+(bare_objc_call
+  .
+  (identifier) @name) @reference.call
+
+(objc_selector_call
+  (possessive)
+  .
+  (identifier) @name) @reference.call
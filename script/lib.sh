@@ -0,0 +1,19 @@
+# Shared setup for the script/ and bench/ tools. Source it, don't run it:
+#
+#   . "$(dirname "$0")/lib.sh"
+#
+# The tree-sitter CLI has to run from the grammar root. This keeps the
+# caller's directory in `here`, changes to the root (`root`) and defines
+# `from_caller PATH`, which turns a caller-relative PATH into one that is
+# still valid from the root.
+
+here=$PWD
+root=$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)
+cd "$root"
+
+from_caller() {
+    case $1 in
+        /*) printf '%s\n' "$1" ;;
+        *) if [ "$here" = "$root" ]; then printf '%s\n' "$1"; else printf '%s\n' "$here/$1"; fi ;;
+    esac
+}